@@ -0,0 +1,845 @@
+// Game state, win detection and robot strategies, shared by index.html and
+// the Node scripts in scripts/. Nothing in here touches the DOM.
+
+const EMPTY = 0;
+const HUMAN = 1;
+const ROBOT = 2;
+const MARKS = { [HUMAN]: "🧑‍💻", [ROBOT]: "🤖" };
+
+// Boards up to 5×5 also keep a bitboard per player, larger ones only `marks`
+const MAX_BITBOARD_CELLS = 25;
+
+// Moves and move counts are stored as one byte each, so a board holds at
+// most 255 boxes
+const MAX_SIZE = 15;
+
+// Bytes before the moves of each exported game: size, win length, first
+// player and move count
+const RECORD_HEADER = 4;
+
+// Row and column steps of the four line directions
+const DIRECTIONS = [
+  [0, 1],
+  [1, 0],
+  [1, 1],
+  [1, -1],
+];
+
+// Robot strategies, each returns the box it wants for `player`
+const robots = {
+  random: chooseRandomBox,
+  perfect: choosePerfectBox,
+  mcts: chooseMctsBox,
+};
+
+// Best box for the player to move on the 3×3 board, keyed by canonicalKey()
+// and given in that canonical orientation
+const openingTable = new Map(
+  typeof OPENING_TABLE !== "undefined"
+    ? OPENING_TABLE
+    : require("./opening-table.js")
+);
+
+// Board geometry and search results, shared by every game of the same shape
+const layouts = new Map();
+const EXACT = 0;
+const LOWER = 1;
+const UPPER = 2;
+
+// Most positions a layout's memo holds before it is emptied. The full 3×3
+// search needs a few hundred, budgeted searches on larger boards would
+// otherwise grow it by hundreds of thousands every move for the whole game.
+const MEMO_LIMIT = 1 << 19;
+
+// Wins outscore any evaluate() result, sooner wins by more
+const WIN_SCORE = 100000;
+
+// Row and column of a box after each of the square's 8 rotations and
+// reflections, for a board `n` boxes wide
+const SYMMETRIES = [
+  (row, col) => [row, col],
+  (row, col, n) => [col, n - 1 - row],
+  (row, col, n) => [n - 1 - row, n - 1 - col],
+  (row, col, n) => [n - 1 - col, row],
+  (row, col, n) => [row, n - 1 - col],
+  (row, col, n) => [n - 1 - row, col],
+  (row, col) => [col, row],
+  (row, col, n) => [n - 1 - col, n - 1 - row],
+];
+
+// Thinking time of searching robots given no finite budget. Only the full
+// 3×3 search is small enough to run without one.
+const DEFAULT_BUDGET_MS = 1000;
+
+// Time limit of the running search, checked every few thousand positions
+const TIMEOUT = new Error("Search budget exhausted");
+let deadline = Infinity;
+let nodes = 0;
+
+// Monte Carlo tree search: exploration weight and how far from existing marks
+// new tree moves are considered
+const EXPLORATION = Math.SQRT2;
+const MCTS_REACH = 2;
+
+// The last search tree with the moves that led to its root, so the next
+// turn can carry on from the matching subtree
+let mctsTree = null;
+
+// Running totals for reporting playouts per second
+const mctsStats = { playouts: 0, elapsedMs: 0 };
+
+// Start an empty `size`×`size` game won by `winLength` marks in a row
+function createGame(size = 3, winLength = size) {
+  if (size > MAX_SIZE) {
+    throw new RangeError(`Boards are at most ${MAX_SIZE}×${MAX_SIZE}`);
+  }
+  const layout = getLayout(size, winLength);
+  return {
+    ...layout,
+    marks: new Uint8Array(layout.cells),
+    masks: [0, 0, 0],
+    history: new Uint8Array(layout.cells),
+    free: Uint8Array.from({ length: layout.cells }, (_, i) => i),
+    freeSlot: Uint8Array.from({ length: layout.cells }, (_, i) => i),
+    freeCount: layout.cells,
+    firstPlayer: HUMAN,
+    moveCount: 0,
+    lastMove: -1,
+  };
+}
+
+// Build the geometry of a board shape once
+function getLayout(size, winLength) {
+  const id = `${size}x${winLength}`;
+  if (!layouts.has(id)) {
+    const cells = size * size;
+    const bitboard = cells <= MAX_BITBOARD_CELLS;
+    const winLines = bitboard ? listLines(size, winLength) : [];
+    const linesThrough = bitboard
+      ? Array.from({ length: cells }, (_, i) =>
+          winLines.filter((line) => line & (1 << i))
+        )
+      : [];
+    layouts.set(id, {
+      size,
+      winLength,
+      cells,
+      bitboard,
+      full: bitboard ? 2 ** cells - 1 : 0,
+      winLines,
+      linesThrough,
+      symmetries: bitboard ? listSymmetries(size) : [],
+      memo: new Map(),
+    });
+  }
+  return layouts.get(id);
+}
+
+// Each symmetry as a box permutation, its inverse, and lookup tables that
+// move the boxes of a bitboard 8 bits at a time
+function listSymmetries(size) {
+  const cells = size * size;
+  return SYMMETRIES.map((symmetry) => {
+    const boxes = new Uint8Array(cells);
+    const inverse = new Uint8Array(cells);
+    for (let index = 0; index < cells; index++) {
+      const [row, col] = symmetry(Math.floor(index / size), index % size, size);
+      boxes[index] = row * size + col;
+      inverse[row * size + col] = index;
+    }
+    const chunks = new Int32Array(Math.ceil(cells / 8) * 256);
+    for (let i = 0; i < chunks.length; i++) {
+      const chunk = i >> 8;
+      for (let bit = 0; bit < 8 && chunk * 8 + bit < cells; bit++) {
+        if (i & (1 << bit)) {
+          chunks[i] |= 1 << boxes[chunk * 8 + bit];
+        }
+      }
+    }
+    return { boxes, inverse, chunks };
+  });
+}
+
+// Every run of `winLength` boxes as a bitboard mask
+function listLines(size, winLength) {
+  const lines = [];
+  for (let row = 0; row < size; row++) {
+    for (let col = 0; col < size; col++) {
+      for (const [dRow, dCol] of DIRECTIONS) {
+        const endRow = row + dRow * (winLength - 1);
+        const endCol = col + dCol * (winLength - 1);
+        if (endRow >= size || endCol < 0 || endCol >= size) {
+          continue;
+        }
+        let line = 0;
+        for (let step = 0; step < winLength; step++) {
+          line |= 1 << ((row + dRow * step) * size + col + dCol * step);
+        }
+        lines.push(line);
+      }
+    }
+  }
+  return lines;
+}
+
+// Record a move
+function placeMark(game, index, player) {
+  if (game.moveCount === 0) {
+    game.firstPlayer = player;
+  }
+  game.marks[index] = player;
+  if (game.bitboard) {
+    game.masks[player] |= 1 << index;
+  }
+  // Swap-remove from the free list, moving its last box into the gap
+  const slot = game.freeSlot[index];
+  const last = game.free[--game.freeCount];
+  game.free[slot] = last;
+  game.freeSlot[last] = slot;
+  game.history[game.moveCount++] = index;
+  game.lastMove = index;
+}
+
+// Take back the last move
+function undoMove(game) {
+  if (game.moveCount === 0) {
+    return;
+  }
+  const index = game.history[--game.moveCount];
+  if (game.bitboard) {
+    game.masks[game.marks[index]] &= ~(1 << index);
+  }
+  game.marks[index] = EMPTY;
+  game.free[game.freeCount] = index;
+  game.freeSlot[index] = game.freeCount++;
+  game.lastMove = game.moveCount ? game.history[game.moveCount - 1] : -1;
+}
+
+// Play the first `moveCount` moves of a record from importGames() or
+// recordGame() onto a new board, players taking turns. Throws on a move
+// outside the board or onto a taken box.
+function replayGame(record, moveCount = record.moves.length) {
+  const game = createGame(record.size, record.winLength);
+  let player = record.firstPlayer;
+  for (let i = 0; i < moveCount; i++) {
+    const index = record.moves[i];
+    if (!(index < game.cells) || game.marks[index] !== EMPTY) {
+      throw new RangeError(`Move ${i} takes box ${index}, which is not free`);
+    }
+    placeMark(game, index, player);
+    player = opponent(player);
+  }
+  return game;
+}
+
+// The moves of a game so far, enough to replay it
+function recordGame(game) {
+  return {
+    size: game.size,
+    winLength: game.winLength,
+    firstPlayer: game.firstPlayer,
+    moves: game.history.slice(0, game.moveCount),
+  };
+}
+
+// Pack games into bytes: a small header then one byte per move
+function exportGames(games) {
+  let length = 0;
+  for (const game of games) {
+    length += RECORD_HEADER + game.moveCount;
+  }
+  const bytes = new Uint8Array(length);
+  let offset = 0;
+  for (const game of games) {
+    offset = writeGame(game, bytes, offset);
+  }
+  return bytes;
+}
+
+// Write one game at `offset`, returning the offset after it
+function writeGame(game, bytes, offset) {
+  bytes[offset] = game.size;
+  bytes[offset + 1] = game.winLength;
+  bytes[offset + 2] = game.firstPlayer;
+  bytes[offset + 3] = game.moveCount;
+  bytes.set(game.history.subarray(0, game.moveCount), offset + RECORD_HEADER);
+  return offset + RECORD_HEADER + game.moveCount;
+}
+
+// Unpack exportGames() bytes into records for replayGame(), the moves are
+// views into `bytes` rather than copies. Throws on a cut-off record, a board
+// larger than MAX_SIZE or an unknown first player.
+function importGames(bytes) {
+  const records = [];
+  let offset = 0;
+  while (offset < bytes.length) {
+    const start = offset + RECORD_HEADER;
+    if (start > bytes.length) {
+      throw new RangeError(`Record at byte ${offset} has a short header`);
+    }
+    const moveCount = bytes[offset + 3];
+    if (start + moveCount > bytes.length) {
+      throw new RangeError(`Record at byte ${offset} is missing moves`);
+    }
+    if (bytes[offset] > MAX_SIZE) {
+      throw new RangeError(
+        `Record at byte ${offset} is larger than ${MAX_SIZE}×${MAX_SIZE}`
+      );
+    }
+    if (bytes[offset + 2] !== HUMAN && bytes[offset + 2] !== ROBOT) {
+      throw new RangeError(`Record at byte ${offset} has no first player`);
+    }
+    records.push({
+      size: bytes[offset],
+      winLength: bytes[offset + 1],
+      firstPlayer: bytes[offset + 2],
+      moves: bytes.subarray(start, start + moveCount),
+    });
+    offset = start + moveCount;
+  }
+  return records;
+}
+
+// The player who moves after `player`
+function opponent(player) {
+  return HUMAN + ROBOT - player;
+}
+
+// Determine win, only the lines through the last move can have changed
+function hasWin(game) {
+  const index = game.lastMove;
+  if (index < 0) {
+    return false;
+  }
+  if (!game.bitboard) {
+    return hasRunThrough(game, index);
+  }
+  const mask = game.masks[game.marks[index]];
+  return game.linesThrough[index].some((line) => hasAllSame(mask, line));
+}
+
+// Determine if a player's bitboard covers every cell of a line
+function hasAllSame(mask, line) {
+  return (mask & line) === line;
+}
+
+// Walk out from a box in each direction counting matching marks, O(winLength).
+// `marks` may be a scratch copy of the board, as used by MCTS playouts.
+function hasRunThrough(game, index, marks = game.marks) {
+  const { size, winLength } = game;
+  const player = marks[index];
+  const row = Math.floor(index / size);
+  const col = index % size;
+  for (const [dRow, dCol] of DIRECTIONS) {
+    let count = 1;
+    for (const sign of [1, -1]) {
+      let r = row + dRow * sign;
+      let c = col + dCol * sign;
+      while (
+        count < winLength &&
+        r >= 0 &&
+        r < size &&
+        c >= 0 &&
+        c < size &&
+        marks[r * size + c] === player
+      ) {
+        count++;
+        r += dRow * sign;
+        c += dCol * sign;
+      }
+    }
+    if (count >= winLength) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Determine if no box is left
+function isFull(game) {
+  return game.moveCount === game.cells;
+}
+
+// Let the `robot` strategy choose a box for `player`, timing how long it
+// thought and counting the MCTS playouts it ran
+function decideRobotBox(game, robot, player, budgetMs) {
+  const start = performance.now();
+  const playouts = mctsStats.playouts;
+  const index = robots[robot](game, player, budgetMs);
+  return {
+    index,
+    thinkMs: performance.now() - start,
+    playouts: mctsStats.playouts - playouts,
+  };
+}
+
+// Choose a random available box from the free list in constant time
+function chooseRandomBox(game) {
+  if (game.freeCount) {
+    return game.free[Math.floor(Math.random() * game.freeCount)];
+  }
+}
+
+// Choose the box with the best minimax score, looking it up when possible.
+// The search deepens until `budgetMs` runs out instead of reaching the end of
+// the game; only 3×3 is searched to the end when the budget is not finite.
+// Only boards with bitboards can be searched, larger ones play randomly.
+function choosePerfectBox(game, player, budgetMs = Infinity) {
+  if (!game.bitboard) {
+    return chooseRandomBox(game);
+  }
+  const own = game.masks[player];
+  const other = game.masks[opponent(player)];
+  if (game.size === 3 && game.winLength === 3) {
+    const { key, symmetry } = canonicalize(game, own, other);
+    const index = openingTable.get(key);
+    if (index !== undefined) {
+      return symmetry.inverse[index];
+    }
+  }
+  if (!Number.isFinite(budgetMs)) {
+    if (game.cells <= 9) {
+      return searchBestBox(game, own, other);
+    }
+    budgetMs = DEFAULT_BUDGET_MS;
+  }
+  return searchWithBudget(game, own, other, budgetMs) ?? chooseRandomBox(game);
+}
+
+// Iterative deepening: search one ply deeper at a time, each pass trying the
+// previous best box first, and keep the answer of the deepest finished pass.
+// The memo carries over from earlier moves; entries searched too shallowly
+// for a pass are skipped by negamax rather than trusted.
+function searchWithBudget(game, own, other, budgetMs) {
+  const free = game.cells - countMarks(own | other);
+  let best;
+  deadline = performance.now() + budgetMs;
+  try {
+    for (let limit = 1; limit <= free; limit++) {
+      best = searchBestBox(game, own, other, limit, best);
+    }
+  } catch (error) {
+    if (error !== TIMEOUT) {
+      throw error;
+    }
+  } finally {
+    deadline = Infinity;
+  }
+  return best;
+}
+
+// Search `limit` plies ahead for the best box for `own`, the player to move
+function searchBestBox(game, own, other, limit = game.cells, first) {
+  const depth = countMarks(own | other);
+  const order = [];
+  for (let index = 0; index < game.cells; index++) {
+    if (!((own | other) & (1 << index)) && index !== first) {
+      order.push(index);
+    }
+  }
+  if (first !== undefined) {
+    order.unshift(first);
+  }
+  let alpha = -Infinity;
+  let best;
+  for (const index of order) {
+    const next = own | (1 << index);
+    const score = scoreMove(
+      game,
+      index,
+      next,
+      other,
+      depth + 1,
+      limit - 1,
+      alpha
+    );
+    if (score > alpha) {
+      alpha = score;
+      best = index;
+    }
+  }
+  return best;
+}
+
+// Score the position after `own` took `index`, from the mover's point of view,
+// searching at most `remaining` more plies
+function scoreMove(
+  game,
+  index,
+  own,
+  other,
+  depth,
+  remaining,
+  alpha,
+  beta = Infinity
+) {
+  if (game.linesThrough[index].some((line) => hasAllSame(own, line))) {
+    return WIN_SCORE - depth;
+  }
+  if ((own | other) === game.full) {
+    return 0;
+  }
+  if (remaining === 0) {
+    return evaluate(game, own, other);
+  }
+  return -negamax(game, other, own, depth, remaining, -beta, -alpha);
+}
+
+// Alpha-beta search for the player to move, memoized by position
+function negamax(game, own, other, depth, remaining, alpha, beta) {
+  if (++nodes % 4096 === 0 && performance.now() > deadline) {
+    throw TIMEOUT;
+  }
+  const key = canonicalKey(game, own, other);
+  const entry = game.memo.get(key);
+  if (entry && entry.remaining >= remaining) {
+    if (entry.flag === EXACT) {
+      return entry.score;
+    }
+    if (entry.flag === LOWER) {
+      alpha = Math.max(alpha, entry.score);
+    } else {
+      beta = Math.min(beta, entry.score);
+    }
+    if (alpha >= beta) {
+      return entry.score;
+    }
+  }
+  const alphaStart = alpha;
+  let best = -Infinity;
+  for (let index = 0; index < game.cells; index++) {
+    const bit = 1 << index;
+    if ((own | other) & bit) {
+      continue;
+    }
+    const next = own | bit;
+    const score = scoreMove(
+      game,
+      index,
+      next,
+      other,
+      depth + 1,
+      remaining - 1,
+      alpha,
+      beta
+    );
+    best = Math.max(best, score);
+    alpha = Math.max(alpha, score);
+    if (alpha >= beta) {
+      break;
+    }
+  }
+  const flag = best <= alphaStart ? UPPER : best >= beta ? LOWER : EXACT;
+  if (game.memo.size >= MEMO_LIMIT) {
+    game.memo.clear();
+  }
+  game.memo.set(key, { score: best, flag, remaining });
+  return best;
+}
+
+// Guess the value of an unfinished position for `own`: every line only one
+// player has started counts for them by how many boxes they hold in it
+function evaluate(game, own, other) {
+  let score = 0;
+  for (const line of game.winLines) {
+    const mine = own & line;
+    const theirs = other & line;
+    if (!theirs) {
+      score += countMarks(mine);
+    } else if (!mine) {
+      score -= countMarks(theirs);
+    }
+  }
+  return score;
+}
+
+// Identify a position by both bitboards, `own` being the player to move
+function positionKey(game, own, other) {
+  return own * (game.full + 1) + other;
+}
+
+// Choose a box by Monte Carlo tree search within `budgetMs`, after taking an
+// immediate win or blocking an immediate loss, which random playouts can miss
+function chooseMctsBox(game, player, budgetMs = DEFAULT_BUDGET_MS) {
+  if (!game.freeCount) {
+    return;
+  }
+  const urgent =
+    findWinningBox(game, player) ?? findWinningBox(game, opponent(player));
+  if (urgent !== undefined) {
+    return urgent;
+  }
+  const start = performance.now();
+  const stop =
+    start + (Number.isFinite(budgetMs) ? budgetMs : DEFAULT_BUDGET_MS);
+  const root = findMctsRoot(game, player);
+  const scratch = new Uint8Array(game.cells);
+  let playouts = 0;
+  do {
+    for (let i = 0; i < 16; i++) {
+      runPlayout(game, root, scratch);
+    }
+    playouts += 16;
+  } while (performance.now() < stop);
+  mctsStats.playouts += playouts;
+  mctsStats.elapsedMs += performance.now() - start;
+  mctsTree = {
+    size: game.size,
+    winLength: game.winLength,
+    history: game.history.slice(0, game.moveCount),
+    root,
+  };
+  let best = root.children[0];
+  for (const child of root.children) {
+    if (child.visits > best.visits) {
+      best = child;
+    }
+  }
+  return best.move;
+}
+
+// A box that wins for `player` right away, if there is one
+function findWinningBox(game, player) {
+  for (let i = 0; i < game.freeCount; i++) {
+    const index = game.free[i];
+    game.marks[index] = player;
+    const wins = hasRunThrough(game, index);
+    game.marks[index] = EMPTY;
+    if (wins) {
+      return index;
+    }
+  }
+}
+
+// Reuse the subtree of the last search when this game continued from it
+function findMctsRoot(game, player) {
+  const tree = mctsTree;
+  if (
+    tree &&
+    tree.size === game.size &&
+    tree.winLength === game.winLength &&
+    tree.history.length <= game.moveCount &&
+    tree.history.every((index, i) => game.history[i] === index)
+  ) {
+    let node = tree.root;
+    for (let i = tree.history.length; node && i < game.moveCount; i++) {
+      node = node.children.find((child) => child.move === game.history[i]);
+    }
+    if (node && node.player === opponent(player)) {
+      return node;
+    }
+  }
+  return createMctsNode(game.lastMove, opponent(player));
+}
+
+// A tree node for the position after `player` took `move`
+function createMctsNode(move, player) {
+  return {
+    move,
+    player,
+    visits: 0,
+    wins: 0,
+    winner: undefined,
+    children: [],
+    untried: null,
+  };
+}
+
+// One MCTS iteration: walk the tree by UCT, add one node, play the rest out
+// at random and credit the result to every node on the way
+function runPlayout(game, root, scratch) {
+  scratch.set(game.marks);
+  let moveCount = game.moveCount;
+  let node = root;
+  const path = [root];
+  while (node.winner === undefined) {
+    if (node.untried === null) {
+      node.untried = listCandidates(game, scratch);
+    }
+    if (node.untried.length) {
+      const i = Math.floor(Math.random() * node.untried.length);
+      const move = node.untried[i];
+      node.untried[i] = node.untried[node.untried.length - 1];
+      node.untried.pop();
+      const child = createMctsNode(move, opponent(node.player));
+      scratch[move] = child.player;
+      moveCount++;
+      if (hasRunThrough(game, move, scratch)) {
+        child.winner = child.player;
+      } else if (moveCount === game.cells) {
+        child.winner = EMPTY;
+      }
+      node.children.push(child);
+      path.push(child);
+      node = child;
+      break;
+    }
+    node = selectChild(node);
+    scratch[node.move] = node.player;
+    moveCount++;
+    path.push(node);
+  }
+  const winner =
+    node.winner ?? simulate(game, scratch, opponent(node.player));
+  for (const visited of path) {
+    visited.visits++;
+    if (winner === visited.player) {
+      visited.wins++;
+    } else if (winner === EMPTY) {
+      visited.wins += 0.5;
+    }
+  }
+}
+
+// The child with the best upper confidence bound
+function selectChild(node) {
+  const logVisits = Math.log(node.visits);
+  let best;
+  let bestScore = -Infinity;
+  for (const child of node.children) {
+    const score =
+      child.wins / child.visits +
+      EXPLORATION * Math.sqrt(logVisits / child.visits);
+    if (score > bestScore) {
+      bestScore = score;
+      best = child;
+    }
+  }
+  return best;
+}
+
+// Free boxes within MCTS_REACH of a mark, or every free box if none are
+function listCandidates(game, marks) {
+  const { size } = game;
+  const candidates = [];
+  const free = [];
+  for (let index = 0; index < game.cells; index++) {
+    if (marks[index] !== EMPTY) {
+      continue;
+    }
+    free.push(index);
+    const row = Math.floor(index / size);
+    const col = index % size;
+    search: for (let r = row - MCTS_REACH; r <= row + MCTS_REACH; r++) {
+      for (let c = col - MCTS_REACH; c <= col + MCTS_REACH; c++) {
+        if (r >= 0 && r < size && c >= 0 && c < size && marks[r * size + c]) {
+          candidates.push(index);
+          break search;
+        }
+      }
+    }
+  }
+  return candidates.length ? candidates : free;
+}
+
+// Play random moves from `marks` until the game ends, returning the winner
+// or EMPTY for a draw
+function simulate(game, marks, player) {
+  const free = [];
+  for (let index = 0; index < game.cells; index++) {
+    if (marks[index] === EMPTY) {
+      free.push(index);
+    }
+  }
+  while (free.length) {
+    const i = Math.floor(Math.random() * free.length);
+    const index = free[i];
+    free[i] = free[free.length - 1];
+    free.pop();
+    marks[index] = player;
+    if (hasRunThrough(game, index, marks)) {
+      return player;
+    }
+    player = opponent(player);
+  }
+  return EMPTY;
+}
+
+// Key shared by all rotations and reflections of a position: the smallest
+// positionKey() among them
+function canonicalKey(game, own, other) {
+  return canonicalize(game, own, other).key;
+}
+
+// The rotation or reflection of a position with the smallest positionKey(),
+// as its key, the symmetry that produced it and both bitboards after it
+function canonicalize(game, own, other) {
+  let best = { key: Infinity };
+  for (const symmetry of game.symmetries) {
+    const ownMask = transformMask(symmetry, own);
+    const otherMask = transformMask(symmetry, other);
+    const key = positionKey(game, ownMask, otherMask);
+    if (key < best.key) {
+      best = { key, symmetry, own: ownMask, other: otherMask };
+    }
+  }
+  return best;
+}
+
+// Move every box of a bitboard as a symmetry does
+function transformMask(symmetry, mask) {
+  let result = 0;
+  for (let offset = 0; mask; offset += 256, mask >>>= 8) {
+    result |= symmetry.chunks[offset + (mask & 255)];
+  }
+  return result;
+}
+
+// Count the set bits of a bitboard
+function countMarks(mask) {
+  let count = 0;
+  for (; mask; mask &= mask - 1) {
+    count++;
+  }
+  return count;
+}
+
+// Shuffle a copy of the input array
+function shuffle(array) {
+  array = array.slice(0);
+  for (let i = array.length - 1; i > 0; i--) {
+    const j = Math.floor(Math.random() * (i + 1));
+    const temp = array[i];
+    array[i] = array[j];
+    array[j] = temp;
+  }
+  return array;
+}
+
+if (typeof module !== "undefined") {
+  module.exports = {
+    EMPTY,
+    HUMAN,
+    ROBOT,
+    MARKS,
+    MAX_SIZE,
+    DEFAULT_BUDGET_MS,
+    RECORD_HEADER,
+    robots,
+    createGame,
+    placeMark,
+    undoMove,
+    replayGame,
+    recordGame,
+    exportGames,
+    writeGame,
+    importGames,
+    opponent,
+    hasWin,
+    hasAllSame,
+    isFull,
+    decideRobotBox,
+    chooseRandomBox,
+    choosePerfectBox,
+    chooseMctsBox,
+    mctsStats,
+    searchBestBox,
+    searchWithBudget,
+    positionKey,
+    canonicalKey,
+    canonicalize,
+    transformMask,
+    countMarks,
+    shuffle,
+  };
+}
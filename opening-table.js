@@ -0,0 +1,87 @@
+// Generated by scripts/build-opening-table.js, do not edit.
+// [canonicalKey(own, other), best box] for every reachable 3×3 position.
+var OPENING_TABLE = [
+  [0, 0], [1, 4], [2, 0], [16, 0], [514, 3], [516, 3], [518, 3], [522, 4],
+  [524, 4], [528, 1], [530, 7], [532, 6], [544, 2], [546, 6], [548, 8], [552, 4],
+  [560, 3], [580, 4], [608, 2], [672, 2], [768, 2], [770, 4], [772, 5], [784, 2],
+  [800, 2], [1025, 3], [1029, 4], [1032, 0], [1033, 6], [1036, 4], [1040, 0], [1041, 8],
+  [1048, 5], [1064, 4], [1088, 0], [1089, 3], [1092, 4], [1096, 0], [1104, 2], [1120, 4],
+  [1152, 0], [1153, 6], [1160, 6], [1168, 0], [1216, 8], [1344, 7], [1548, 4], [1556, 6],
+  [1560, 2], [1564, 5], [1572, 8], [1576, 2], [1580, 4], [1584, 2], [1588, 3], [1604, 4],
+  [1608, 2], [1612, 4], [1616, 2], [1624, 2], [1632, 2], [1636, 3], [1640, 2], [1648, 2],
+  [1668, 6], [1672, 2], [1676, 4], [1680, 2], [1684, 6], [1688, 2], [1696, 2], [1700, 8],
+  [1704, 2], [1712, 2], [1728, 2], [1732, 3], [1736, 2], [1744, 2], [1760, 2], [1796, 5],
+  [1800, 2], [1804, 5], [1808, 2], [1812, 3], [1816, 2], [1824, 2], [1832, 2], [1840, 2],
+  [1856, 2], [1860, 3], [1864, 2], [1872, 2], [1888, 2], [1920, 2], [1924, 3], [1928, 2],
+  [1936, 2], [1952, 2], [2570, 4], [2578, 7], [2584, 1], [2586, 5], [2600, 1], [2602, 4],
+  [2626, 8], [2632, 1], [2634, 8], [2640, 1], [2642, 7], [2648, 1], [2656, 1], [2658, 4],
+  [2664, 1], [2672, 1], [2690, 4], [2696, 1], [2698, 4], [2704, 1], [2712, 1], [2728, 1],
+  [2752, 1], [2754, 3], [2760, 1], [2768, 1], [2784, 1], [2880, 1], [2882, 7], [2888, 1],
+  [2896, 1], [5125, 4], [5137, 8], [5140, 6], [5141, 5], [5153, 2], [5156, 8], [5157, 8],
+  [5168, 0], [5169, 8], [5172, 0], [5188, 4], [5189, 4], [5216, 2], [5217, 4], [5220, 0],
+  [5232, 2], [5280, 0], [5281, 8], [5284, 8], [5296, 0], [5377, 4], [5380, 5], [5381, 4],
+  [5392, 0], [5396, 0], [5408, 2], [5409, 2], [5424, 0], [5444, 0], [5472, 0], [5536, 0],
+  [5684, 6], [5732, 4], [5744, 2], [5796, 6], [5808, 2], [5812, 6], [5860, 4], [5908, 6],
+  [5936, 2], [5956, 4], [5984, 2], [6000, 2], [6048, 2], [6064, 2], [6147, 4], [6161, 8],
+  [6162, 7], [6163, 5], [6177, 1], [6178, 6], [6179, 4], [6192, 0], [6193, 8], [6194, 7],
+  [6209, 5], [6210, 5], [6211, 5], [6224, 0], [6225, 8], [6226, 7], [6240, 0], [6241, 4],
+  [6242, 4], [6256, 0], [6273, 4], [6274, 4], [6275, 4], [6288, 1], [6289, 1], [6304, 0],
+  [6305, 4], [6306, 4], [6320, 1], [6336, 8], [6337, 8], [6338, 0], [6352, 0], [6368, 8],
+  [6401, 4], [6402, 4], [6403, 4], [6416, 0], [6418, 0], [6432, 0], [6433, 4], [6434, 6],
+  [6448, 0], [6464, 7], [6465, 1], [6466, 7], [6480, 0], [6496, 7], [6528, 6], [6529, 1],
+  [6530, 0], [6544, 0], [6560, 6], [6706, 6], [6738, 7], [6754, 4], [6768, 1], [6770, 7],
+  [6818, 6], [6832, 1], [6850, 4], [6864, 1], [6880, 1], [6882, 4], [6896, 1], [6930, 6],
+  [6946, 6], [6960, 1], [6962, 6], [6978, 7], [6992, 1], [6994, 7], [7008, 1], [7010, 7],
+  [7024, 1], [7042, 6], [7056, 1], [7072, 1], [7074, 6], [7088, 1], [7217, 8], [7249, 8],
+  [7265, 4], [7280, 0], [7281, 8], [7313, 8], [7329, 4], [7344, 0], [7345, 8], [7361, 8],
+  [7376, 0], [7377, 8], [7392, 0], [7393, 8], [7408, 0], [7457, 4], [7472, 0], [7489, 4],
+  [7504, 0], [7520, 0], [7521, 4], [7536, 0], [7553, 4], [7568, 0], [7584, 0], [7585, 4],
+  [7600, 0], [8193, 1], [8194, 0], [8195, 2], [8197, 1], [8202, 0], [8204, 0], [8232, 0],
+  [8260, 1], [8710, 8], [8714, 8], [8716, 8], [8718, 8], [8738, 8], [8740, 8], [8742, 8],
+  [8744, 8], [8746, 8], [8748, 8], [8772, 8], [8774, 8], [8800, 8], [8802, 8], [8804, 8],
+  [8808, 8], [8864, 8], [8866, 8], [8868, 8], [8962, 3], [8964, 5], [8966, 5], [8970, 2],
+  [8972, 5], [8992, 2], [8994, 2], [9000, 2], [9028, 1], [9056, 1], [9120, 1], [9221, 7],
+  [9225, 7], [9228, 7], [9229, 7], [9256, 7], [9257, 7], [9281, 7], [9284, 7], [9285, 7],
+  [9288, 7], [9292, 7], [9312, 7], [9313, 7], [9316, 7], [9320, 7], [9345, 3], [9349, 3],
+  [9352, 0], [9353, 6], [9356, 6], [9384, 0], [9408, 8], [9409, 2], [9412, 8], [9416, 0],
+  [9440, 8], [9536, 7], [9537, 7], [9544, 7], [9772, 7], [9804, 7], [9828, 7], [9832, 2],
+  [9836, 7], [9868, 8], [9892, 8], [9896, 2], [9900, 8], [9924, 8], [9928, 2], [9932, 8],
+  [9952, 2], [9956, 8], [9960, 2], [9996, 7], [10024, 2], [10052, 7], [10056, 2], [10060, 7],
+  [10080, 2], [10088, 2], [10116, 3], [10120, 2], [10124, 5], [10144, 2], [10152, 2], [10794, 6],
+  [10826, 8], [10850, 8], [10856, 1], [10858, 8], [10890, 6], [10920, 1], [10922, 6], [10946, 8],
+  [10952, 1], [10954, 8], [10976, 1], [10978, 8], [10984, 1], [11074, 7], [11080, 1], [11082, 7],
+  [11112, 1], [13349, 7], [13381, 5], [13409, 7], [13412, 7], [13413, 7], [13473, 2], [13476, 8],
+  [13477, 8], [13540, 8], [13573, 5], [13601, 7], [13636, 5], [13637, 5], [13664, 7], [13665, 7],
+  [13728, 0], [13729, 2], [14052, 8], [14371, 6], [14403, 5], [14433, 1], [14434, 0], [14435, 7],
+  [14467, 5], [14497, 6], [14498, 6], [14499, 6], [14529, 5], [14530, 5], [14531, 5], [14560, 8],
+  [14561, 8], [14562, 8], [14595, 5], [14625, 6], [14626, 6], [14627, 6], [14657, 5], [14658, 5],
+  [14659, 5], [14688, 7], [14689, 7], [14690, 7], [14721, 5], [14722, 5], [14723, 5], [14752, 6],
+  [14753, 6], [14754, 6], [15074, 8], [15202, 7], [15266, 6], [15585, 8], [15713, 7], [15777, 6],
+  [20483, 4], [20485, 4], [20497, 8], [20498, 7], [20499, 2], [20501, 1], [20545, 4], [20546, 4],
+  [20547, 4], [20548, 4], [20549, 4], [20550, 4], [20561, 1], [20562, 0], [20610, 4], [20611, 4],
+  [20613, 4], [21014, 6], [21062, 4], [21074, 2], [21126, 4], [21140, 6], [21186, 4], [21188, 4],
+  [21190, 4], [21200, 1], [21254, 4], [21266, 6], [21268, 6], [21270, 6], [21314, 4], [21316, 4],
+  [21318, 4], [21328, 1], [21330, 2], [21378, 4], [21380, 4], [21382, 4], [21392, 6], [21396, 6],
+  [21525, 6], [21573, 4], [21585, 2], [21637, 4], [21649, 8], [21653, 6], [21697, 4], [21700, 4],
+  [21701, 4], [21712, 0], [21713, 2], [21825, 4], [21829, 4], [21840, 0], [22420, 6], [23378, 7],
+  [34819, 4], [34826, 4], [34827, 4], [34833, 8], [34834, 7], [34835, 3], [34842, 0], [34849, 4],
+  [34850, 4], [34851, 4], [34856, 4], [34857, 4], [34858, 4], [34865, 1], [34866, 0], [34977, 4],
+  [35073, 4], [35075, 4], [35354, 5], [35370, 4], [35378, 3], [35490, 3], [35498, 4], [35504, 1],
+  [35594, 4], [35602, 3], [35610, 5], [35618, 3], [35624, 1], [35626, 4], [35632, 1], [35634, 3],
+  [35744, 1], [35746, 3], [35760, 1], [35865, 5], [35881, 4], [35889, 3], [35977, 4], [35985, 8],
+  [35992, 0], [35993, 5], [36001, 4], [36008, 0], [36009, 4], [36016, 0], [36017, 3], [36105, 4],
+  [36120, 0], [36129, 4], [36136, 0], [36137, 4], [36144, 0], [36225, 4], [36232, 0], [36233, 4],
+  [36240, 0], [36248, 0], [36256, 0], [36257, 4], [36264, 0], [36272, 0], [40113, 8], [40353, 4],
+  [40368, 0], [49678, 8], [49686, 3], [49690, 7], [49692, 1], [49694, 7], [49798, 3], [49802, 4],
+  [49804, 1], [49806, 4], [49812, 3], [49820, 1], [49926, 3], [49932, 1], [49934, 4], [49940, 3],
+  [49942, 3], [49948, 1], [50054, 3], [50189, 7], [50197, 8], [50201, 8], [50204, 0], [50205, 8],
+  [50309, 3], [50313, 2], [50316, 0], [50317, 4], [50321, 8], [50325, 8], [50328, 2], [50329, 8],
+  [50332, 0], [50437, 4], [50441, 4], [50445, 4], [50569, 4], [50844, 8], [50972, 7], [51084, 4],
+  [51092, 3], [51096, 2], [51994, 7], [52106, 4], [52120, 1], [52377, 8], [52617, 4], [54421, 8],
+  [54661, 4], [54676, 0], [55683, 4], [57998, 8], [58126, 7], [58246, 3], [58509, 8], [58637, 7],
+  [58761, 2], [87365, 4], [166570, 4],
+];
+
+if (typeof module !== "undefined") {
+  module.exports = OPENING_TABLE;
+}
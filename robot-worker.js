@@ -0,0 +1,8 @@
+// Runs the robot's search off the main thread for index.html. The memo
+// tables in game.js live as long as the worker, so they carry over turns.
+importScripts("opening-table.js", "game.js");
+
+onmessage = ({ data }) => {
+  const game = replayGame(data.record);
+  postMessage(decideRobotBox(game, data.robot, data.player, data.budgetMs));
+};
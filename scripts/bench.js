@@ -0,0 +1,140 @@
+// Time the per-move hot path of game.js on fixed board fixtures. Results go
+// to stdout as JSON and a readable summary goes to stderr.
+//
+//   node scripts/bench.js > bench.json
+//   node scripts/bench.js --time=1000 --filter=hasWin
+//
+// runRobotTurn() is measured through each strategy in game.robots, which is
+// what it calls to choose the robot's box. MCTS always thinks for its whole
+// time budget, so it is left out; selfplay.js reports its playouts/s instead.
+
+const game = require("../game.js");
+const { parseOptions } = require("./options.js");
+
+const options = parseOptions(process.argv.slice(2));
+const sampleMs = Number(options.time ?? 200);
+const filter = options.filter ?? "";
+const SAMPLES = 5;
+
+const shapes = [
+  [3, 3],
+  [15, 5],
+];
+const fixtures = { empty: 0, midGame: 0.5, nearFull: 1 };
+
+const cases = [];
+for (const [size, winLength] of shapes) {
+  for (const [fixture, fill] of Object.entries(fixtures)) {
+    const board = createFixture(size, winLength, fill);
+    const label = `${size}x${size}/${winLength}`;
+    const addCase = (name, run) =>
+      cases.push({ name, board: label, fixture, run });
+    // An empty board has no last move, so hasWin() would only time its
+    // early return
+    if (board.moveCount) {
+      addCase("hasWin", () => game.hasWin(board));
+    }
+    if (board.bitboard) {
+      const mask = board.masks[game.HUMAN];
+      addCase("hasAllSame", () => {
+        let hits = 0;
+        for (const line of board.winLines) {
+          hits += game.hasAllSame(mask, line);
+        }
+        return hits;
+      });
+    }
+    const indices = Array.from({ length: board.cells }, (_, i) => i);
+    addCase("shuffle", () => game.shuffle(indices));
+    // Without bitboards the perfect robot plays randomly, which is already
+    // timed as runRobotTurn:random
+    const player = board.moveCount % 2 ? game.ROBOT : game.HUMAN;
+    for (const [robot, chooseBox] of Object.entries(game.robots)) {
+      if (robot === "mcts" || (robot === "perfect" && !board.bitboard)) {
+        continue;
+      }
+      addCase(`runRobotTurn:${robot}`, () => chooseBox(board, player));
+    }
+  }
+}
+
+const results = [];
+for (const { run, ...info } of cases) {
+  if (!`${info.name} ${info.board} ${info.fixture}`.includes(filter)) {
+    continue;
+  }
+  const nsPerOp = Number(measure(run).toFixed(2));
+  results.push({ ...info, nsPerOp, opsPerSec: Math.round(1e9 / nsPerOp) });
+  console.error(
+    `${info.name.padEnd(24)} ${info.board.padEnd(8)} ` +
+      `${info.fixture.padEnd(8)} ${nsPerOp.toFixed(2).padStart(10)} ns/op`
+  );
+}
+console.log(
+  JSON.stringify({ node: process.version, sampleMs, results }, null, 2)
+);
+
+// Median nanoseconds per call over several timed samples
+function measure(run) {
+  let sink = 0;
+  let iterations = 1;
+  // Grow the batch until one sample takes long enough to time reliably
+  for (;;) {
+    const start = process.hrtime.bigint();
+    for (let i = 0; i < iterations; i++) {
+      sink ^= Number(run()) | 0;
+    }
+    if (Number(process.hrtime.bigint() - start) >= (sampleMs * 1e6) / 10) {
+      break;
+    }
+    iterations *= 2;
+  }
+  iterations *= 10;
+  const samples = [];
+  for (let s = 0; s < SAMPLES; s++) {
+    const start = process.hrtime.bigint();
+    for (let i = 0; i < iterations; i++) {
+      sink ^= Number(run()) | 0;
+    }
+    samples.push(Number(process.hrtime.bigint() - start) / iterations);
+  }
+  measure.sink = sink;
+  return samples.sort((a, b) => a - b)[SAMPLES >> 1];
+}
+
+// A game with `fill` of its boxes taken, leaving at least two free. Players
+// alternate from an empty board, as in real play, so 3×3 fixtures are
+// positions the opening table knows. Boxes are taken in a fixed
+// pseudo-random order so runs are repeatable, skipping any box that would
+// win so no fixture is already over.
+function createFixture(size, winLength, fill) {
+  const board = game.createGame(size, winLength);
+  const order = seededShuffle(board.cells, size * 31 + winLength);
+  const count = Math.min(Math.round(board.cells * fill), board.cells - 2);
+  let player = game.HUMAN;
+  for (const index of order) {
+    if (board.moveCount === count) {
+      break;
+    }
+    game.placeMark(board, index, player);
+    if (game.hasWin(board)) {
+      game.undoMove(board);
+      continue;
+    }
+    player = game.opponent(player);
+  }
+  return board;
+}
+
+// Box indices in an order fixed by `seed` (mulberry32)
+function seededShuffle(length, seed) {
+  const indices = Array.from({ length }, (_, i) => i);
+  for (let i = length - 1; i > 0; i--) {
+    seed = (seed + 0x6d2b79f5) | 0;
+    let t = Math.imul(seed ^ (seed >>> 15), seed | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    const j = ((t ^ (t >>> 14)) >>> 0) % (i + 1);
+    [indices[i], indices[j]] = [indices[j], indices[i]];
+  }
+  return indices;
+}
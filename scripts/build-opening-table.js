@@ -0,0 +1,69 @@
+// Generate opening-table.js: the perfect-play box for every reachable 3×3
+// position, so the robot never has to search at runtime. Rotations and
+// reflections of a position share one entry, stored in canonical orientation.
+//
+//   node scripts/build-opening-table.js
+
+const fs = require("fs");
+const path = require("path");
+
+// Search from scratch rather than trusting a previously generated table
+globalThis.OPENING_TABLE = [];
+const game = require("../game.js");
+
+const board = game.createGame(3);
+const table = new Map();
+visit(0, 0);
+
+// Walk every position reachable from `own` to move against `other`
+function visit(own, other) {
+  const canonical = game.canonicalize(board, own, other);
+  if (table.has(canonical.key)) {
+    return;
+  }
+  table.set(
+    canonical.key,
+    game.searchBestBox(board, canonical.own, canonical.other)
+  );
+  for (let index = 0; index < board.cells; index++) {
+    const next = own | (1 << index);
+    if ((own | other) & (1 << index) || isOver(index, next, other)) {
+      continue;
+    }
+    visit(other, next);
+  }
+}
+
+// Determine if `own` taking `index` ended the game
+function isOver(index, own, other) {
+  return (
+    board.linesThrough[index].some((line) => game.hasAllSame(own, line)) ||
+    (own | other) === board.full
+  );
+}
+
+const entries = [...table].sort(([a], [b]) => a - b);
+const lines = [];
+for (let i = 0; i < entries.length; i += 8) {
+  lines.push(
+    "  " +
+      entries
+        .slice(i, i + 8)
+        .map(([key, box]) => `[${key}, ${box}],`)
+        .join(" ")
+  );
+}
+fs.writeFileSync(
+  path.join(__dirname, "..", "opening-table.js"),
+  `// Generated by scripts/build-opening-table.js, do not edit.
+// [canonicalKey(own, other), best box] for every reachable 3×3 position.
+var OPENING_TABLE = [
+${lines.join("\n")}
+];
+
+if (typeof module !== "undefined") {
+  module.exports = OPENING_TABLE;
+}
+`
+);
+console.log(`${entries.length} positions written to opening-table.js`);
@@ -0,0 +1,15 @@
+// Command-line parsing shared by the scripts in this folder
+
+// Read --key=value arguments
+function parseOptions(args) {
+  const result = {};
+  for (const arg of args) {
+    const [, key, value] = arg.match(/^--([^=]+)=?(.*)$/) ?? [];
+    if (key) {
+      result[key] = value;
+    }
+  }
+  return result;
+}
+
+module.exports = { parseOptions };
@@ -0,0 +1,64 @@
+// Load games saved by `selfplay.js --record` and replay them, either all of
+// them for a summary or one of them move by move.
+//
+//   node scripts/replay.js games.bin
+//   node scripts/replay.js games.bin --game=42
+
+const fs = require("fs");
+const game = require("../game.js");
+
+const [file, ...args] = process.argv.slice(2);
+const only = args.find((arg) => arg.startsWith("--game="));
+const bytes = new Uint8Array(fs.readFileSync(file));
+const records = game.importGames(bytes);
+
+if (only) {
+  const text = only.slice("--game=".length);
+  const number = /^\d+$/.test(text) ? Number(text) : -1;
+  if (number < 0 || number >= records.length) {
+    console.error(
+      `Usage: node scripts/replay.js games.bin --game=N, where N is 0 to ` +
+        `${records.length - 1}`
+    );
+    process.exit(1);
+  }
+  const record = records[number];
+  for (let moveCount = 1; moveCount <= record.moves.length; moveCount++) {
+    const board = game.replayGame(record, moveCount);
+    console.log(`Move ${moveCount}: box ${board.lastMove}`);
+    console.log(draw(board));
+  }
+} else {
+  const wins = { [game.HUMAN]: 0, [game.ROBOT]: 0 };
+  let draws = 0;
+  const start = process.hrtime.bigint();
+  for (const record of records) {
+    const board = game.replayGame(record);
+    if (game.hasWin(board)) {
+      wins[board.marks[board.lastMove]]++;
+    } else {
+      draws++;
+    }
+  }
+  const seconds = Number(process.hrtime.bigint() - start) / 1e9;
+  console.log(
+    `${records.length} games in ${bytes.length} bytes, replayed in ` +
+      `${seconds.toFixed(2)}s`
+  );
+  console.log(
+    `${game.MARKS[game.HUMAN]} ${wins[game.HUMAN]} wins, ` +
+      `${game.MARKS[game.ROBOT]} ${wins[game.ROBOT]} wins, ${draws} draws`
+  );
+}
+
+// The board as rows of marks, dots for free boxes
+function draw(board) {
+  const rows = [];
+  for (let row = 0; row < board.size; row++) {
+    const marks = board.marks.subarray(row * board.size, (row + 1) * board.size);
+    rows.push(
+      Array.from(marks, (player) => game.MARKS[player] ?? "·").join(" ")
+    );
+  }
+  return rows.join("\n");
+}
@@ -0,0 +1,136 @@
+// Play robots against each other outside the browser using the same game.js
+// as index.html, then report throughput, results and per-move latency.
+//
+//   node scripts/selfplay.js --games=1000000 --a=perfect --b=random
+//   node scripts/selfplay.js --games=1000 --size=15 --win=5
+//   node scripts/selfplay.js --games=100 --size=5 --win=4 --a=perfect --budget=20
+//   node scripts/selfplay.js --games=20 --size=15 --win=5 --a=mcts --budget=100
+//   node scripts/selfplay.js --games=1000000 --record=games.bin
+//
+// Robot A moves first in even games and robot B in odd ones. Searching
+// robots think for --budget milliseconds per move, by default 1000 on boards
+// larger than 3×3 and to the end of the game on 3×3. --record saves
+// every game in the exportGames() format for scripts/replay.js.
+
+const fs = require("fs");
+const game = require("../game.js");
+const { parseOptions } = require("./options.js");
+
+const options = parseOptions(process.argv.slice(2));
+const games = Number(options.games ?? 100000);
+const size = Number(options.size ?? 3);
+const winLength = Number(options.win ?? Math.min(size, 5));
+// Only 3×3 is small enough to search to the end without a time budget
+const budgetMs = Number(
+  options.budget ?? (size === 3 ? Infinity : game.DEFAULT_BUDGET_MS)
+);
+if (!(budgetMs > 0)) {
+  throw new Error("--budget must be a positive number of milliseconds");
+}
+const sides = [
+  { name: options.a ?? "random", wins: 0, latency: new Reservoir(100000) },
+  { name: options.b ?? "random", wins: 0, latency: new Reservoir(100000) },
+];
+for (const side of sides) {
+  if (!Object.hasOwn(game.robots, side.name)) {
+    throw new Error(`Unknown robot "${side.name}"`);
+  }
+  side.chooseBox = game.robots[side.name];
+}
+
+let recorded = new Uint8Array(options.record ? 1 << 20 : 0);
+let recordedLength = 0;
+
+let draws = 0;
+let moves = 0;
+const start = process.hrtime.bigint();
+for (let i = 0; i < games; i++) {
+  const board = game.createGame(size, winLength);
+  const first = i % 2;
+  let turn = 0;
+  for (;;) {
+    const side = sides[(first + turn) % 2];
+    const player = turn % 2 ? game.ROBOT : game.HUMAN;
+    const moveStart = process.hrtime.bigint();
+    const index = side.chooseBox(board, player, budgetMs);
+    side.latency.add(Number(process.hrtime.bigint() - moveStart));
+    game.placeMark(board, index, player);
+    moves++;
+    if (game.hasWin(board)) {
+      side.wins++;
+      break;
+    }
+    if (game.isFull(board)) {
+      draws++;
+      break;
+    }
+    turn++;
+  }
+  if (options.record) {
+    record(board);
+  }
+}
+const seconds = Number(process.hrtime.bigint() - start) / 1e9;
+
+console.log(`${games} games on ${size}×${size}, ${winLength} in a row`);
+console.log(
+  `${format(games / seconds)} games/s, ${format(moves / seconds)} moves/s`
+);
+for (const [label, side] of [["A", sides[0]], ["B", sides[1]]]) {
+  const [p50, p90, p99, max] = [0.5, 0.9, 0.99, 1].map((q) =>
+    side.latency.percentile(q)
+  );
+  console.log(
+    `${label} ${side.name}: ${percent(side.wins / games)} wins, move ` +
+      `p50 ${micros(p50)} p90 ${micros(p90)} p99 ${micros(p99)} ` +
+      `max ${micros(max)}`
+  );
+}
+console.log(`draws: ${percent(draws / games)}`);
+if (game.mctsStats.playouts) {
+  const { playouts, elapsedMs } = game.mctsStats;
+  console.log(`mcts: ${format((playouts / elapsedMs) * 1000)} playouts/s`);
+}
+if (options.record) {
+  fs.writeFileSync(options.record, recorded.subarray(0, recordedLength));
+  console.log(`${recordedLength} bytes written to ${options.record}`);
+}
+
+// Append a finished game to the recording, growing it as needed
+function record(board) {
+  if (recordedLength + game.RECORD_HEADER + board.moveCount > recorded.length) {
+    const grown = new Uint8Array(recorded.length * 2);
+    grown.set(recorded);
+    recorded = grown;
+  }
+  recordedLength = game.writeGame(board, recorded, recordedLength);
+}
+
+// Keep a uniform sample of at most `capacity` values for percentiles
+function Reservoir(capacity) {
+  const samples = new Float64Array(capacity);
+  let seen = 0;
+  this.add = (value) => {
+    const slot = seen < capacity ? seen : Math.floor(Math.random() * (seen + 1));
+    if (slot < capacity) {
+      samples[slot] = value;
+    }
+    seen++;
+  };
+  this.percentile = (q) => {
+    const sorted = samples.slice(0, Math.min(seen, capacity)).sort();
+    return sorted[Math.min(sorted.length - 1, Math.floor(q * sorted.length))];
+  };
+}
+
+function format(value) {
+  return Math.round(value).toLocaleString("en-US");
+}
+
+function percent(value) {
+  return `${(value * 100).toFixed(1)}%`;
+}
+
+function micros(nanoseconds) {
+  return `${(nanoseconds / 1000).toFixed(2)}µs`;
+}